@@ -0,0 +1,42 @@
+// Dense two-phase simplex on random 500 x 500 LPs
+// snippet: optimization.md Linear Programming
+#include "snippets.h"
+
+using vd = vector<double>;
+
+// Best of reps runs in ms, with the optimum and the largest constraint violation
+void run(const char* name, const vector<vd>& A, const vd& b, const vd& c, int reps) {
+    double best = 1e18, value = 0, violation = 0;
+    for (int it = 0; it < reps; ++it) {
+        const auto t0 = chrono::steady_clock::now();
+        vd x;
+        simplex lp(A, b, c);
+        value = lp.solve(x);
+        best = min(best, chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count());
+
+        violation = 0;
+        for (int i = 0; i < ssize(A); ++i) {
+            violation = max(violation, inner_product(A[i].begin(), A[i].end(), x.begin(), 0.0) - b[i]);
+        }
+    }
+    printf("%-28s %9.1f ms   optimum %.6f   max violation %.1e\n", name, best, value, violation);
+}
+
+int32_t main() {
+    const int n = 500;
+    mt19937 gen(1);
+    uniform_real_distribution<double> u(0, 1);
+    vector<vd> A(n, vd(n));
+    vd b(n), c(n);
+
+    // b > 0: the origin is feasible, phase 2 only
+    for (auto& r : A) ranges::generate(r, [&] { return u(gen); });
+    ranges::generate(b, [&] { return 1 + 9 * u(gen); });
+    ranges::generate(c, [&] { return u(gen); });
+    run("500x500, b > 0", A, b, c, 5);
+
+    // Mixed-sign A and b: phase 1 has to find a feasible basis first
+    for (auto& r : A) ranges::generate(r, [&] { return 2 * u(gen) - 1; });
+    ranges::generate(b, [&] { return 10 * u(gen) - 3; });
+    run("500x500, mixed-sign b", A, b, c, 3);
+}
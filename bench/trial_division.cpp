@@ -0,0 +1,99 @@
+// Trial division through fast_div / trial::next_divisor against the plain % loops
+// snippet: number-theory.md Fast Division
+// snippet: number-theory.md Euler's Totient Function
+// snippet: number-theory.md Divisors
+// snippet: number-theory.md Prime Factors
+#include "snippets.h"
+
+// The loops the snippets used before fast division
+namespace plain {
+
+    int phi(int n) {
+        int res = n;
+        for (int p = 2; p * p <= n; ++p) {
+            if (n % p == 0) {
+                while (n % p == 0) n /= p;
+                res -= res / p;
+            }
+        }
+        if (n > 1) res -= res / n;
+        return res;
+    }
+
+    vector<int> divisors(int n) {
+        vector<int> res;
+        for (int i = 1; i * i <= n; ++i) {
+            if (n % i == 0) {
+                res.push_back(i);
+                if (i != n / i) res.push_back(n / i);
+            }
+        }
+        ranges::sort(res);
+        return res;
+    }
+
+    vector<pair<int, int>> factors(int n) {
+        vector<pair<int, int>> res;
+        for (int p = 2; p * p <= n; ++p) {
+            if (n % p == 0) {
+                int exp = 0;
+                while (n % p == 0) {
+                    n /= p;
+                    ++exp;
+                }
+                res.emplace_back(p, exp);
+            }
+        }
+        if (n > 1) res.emplace_back(n, 1);
+        return res;
+    }
+}
+
+template<typename F>
+double time_ms(F&& f) {
+    const auto t0 = chrono::steady_clock::now();
+    f();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+}
+
+template<typename F, typename G>
+void compare(const char* name, F&& old_fn, G&& new_fn) {
+    decltype(old_fn()) a, b;
+    const double t_old = time_ms([&] { a = old_fn(); });
+    const double t_new = time_ms([&] { b = new_fn(); });
+    printf("%-34s %9.2f ms -> %9.2f ms  x%.2f%s\n", name, t_old, t_new, t_old / t_new, a == b ? "" : "  MISMATCH");
+}
+
+int32_t main() {
+    // First calls in the process: nothing is cached yet. Three distinct
+    // primes, read through volatile so the plain calls cannot be folded
+    volatile int opaque[] = {999'999'999'989, 999'999'999'961, 999'999'999'959};
+    const int p1 = opaque[0], p2 = opaque[1], p3 = opaque[2];
+    compare("phi(prime ~1e12), cold", [&] { return plain::phi(p1); }, [&] { return euler::phi(p1); });
+    compare("phi(prime ~1e12), second call", [&] { return plain::phi(p2); }, [&] { return euler::phi(p2); });
+    compare("phi(prime ~1e12), warm", [&] { return plain::phi(p3); }, [&] { return euler::phi(p3); });
+
+    mt19937_64 gen(1);
+    vector<int> qs(20'000);
+    for (int& q : qs) q = gen() % 1'000'000'000 + 1;
+
+    auto over_queries = [&](auto f) {
+        return [&, f] {
+            int64_t sum = 0;
+            for (int q : qs) {
+                for (int x : f(q)) sum += x;
+            }
+            return sum;
+        };
+    };
+    compare("phi, 2e4 queries <= 1e9",
+            [&] { int64_t s = 0; for (int q : qs) s += plain::phi(q); return s; },
+            [&] { int64_t s = 0; for (int q : qs) s += euler::phi(q); return s; });
+    compare("divisors::get, 2e4 queries <= 1e9", over_queries(plain::divisors), over_queries(divisors::get));
+    compare("divisors::count, 2e4 queries <= 1e9",
+            [&] { int64_t s = 0; for (int q : qs) s += ssize(plain::divisors(q)); return s; },
+            [&] { int64_t s = 0; for (int q : qs) s += divisors::count(q); return s; });
+    compare("prime_factors::get, 2e4 queries <= 1e9",
+            [&] { int64_t s = 0; for (int q : qs) for (auto [p, e] : plain::factors(q)) s += p * e; return s; },
+            [&] { int64_t s = 0; for (int q : qs) for (auto [p, e] : prime_factors::get(q)) s += p * e; return s; });
+}
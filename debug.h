@@ -7,6 +7,14 @@
 #include <type_traits>
 #include <utility>
 #include <concepts>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+#include <sys/resource.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
 
 /* ANSI color codes */
 #define DBG_RESET  "\033[0m"
@@ -59,6 +67,21 @@ concept PriorityQueue = requires(T t) {
     { t.pop() };
 };
 
+// Multi-dimensional arrays and strided views (ndarray / nd_view)
+template<typename T>
+concept NDArray = requires(const T& t) {
+    { T::rank } -> std::convertible_to<int>;
+    { t.extent(0) } -> std::convertible_to<long long>;
+    t[0];
+};
+
+// Containers that can list their contents without being modified
+// (pairing_heap, radix_heap, bucket_queue)
+template<typename T>
+concept Snapshot = requires(const T& t) {
+    { t.snapshot() } -> Iterable;
+};
+
 // Forward declaration
 template<typename T>
 std::string to_debug_string(const T& val);
@@ -115,19 +138,26 @@ std::string queue_to_string(T q) {
 }
 
 // Priority queue printing helper
+// Reads the protected container and comparator and sorts a copy of the
+// elements into pop order instead of popping a copy of the whole queue
 template<PriorityQueue T>
-std::string priority_queue_to_string(T pq) {
+std::string priority_queue_to_string(const T& pq) {
+    struct access : T {
+        static const typename T::container_type& items(const T& q) { return q.*(&access::c); }
+        static const typename T::value_compare& compare(const T& q) { return q.*(&access::comp); }
+    };
+    auto items = access::items(pq);
+    const auto& comp = access::compare(pq);
+    std::ranges::sort(items, [&](const auto& a, const auto& b) { return comp(b, a); });
+
     std::ostringstream oss;
     oss << "[";
-
     bool first = true;
-    while (!pq.empty()) {
+    for (const auto& item : items) {
         if (!first) oss << ", ";
-        oss << to_debug_string(pq.top());
-        pq.pop();
+        oss << to_debug_string(item);
         first = false;
     }
-
     oss << "]";
     return oss.str();
 }
@@ -158,6 +188,17 @@ std::string to_debug_string(const T& val) {
         else
             oss << val;
     }
+    else if constexpr (Snapshot<Type>) {
+        oss << to_debug_string(val.snapshot());
+    }
+    else if constexpr (NDArray<Type>) {
+        oss << "[";
+        for (long long i = 0; i < val.extent(0); ++i) {
+            if (i > 0) oss << ", ";
+            oss << to_debug_string(val[i]);
+        }
+        oss << "]";
+    }
     else if constexpr (Pair<Type>) {
         oss << "(" << to_debug_string(val.first) << ", " << to_debug_string(val.second) << ")";
     }
@@ -307,4 +348,94 @@ void debug_carray_impl(const char* name, const T* arr, const size_t len) {
                                 << " " << __func__ << "() at " \
                                 << __FILE__ << ":" << __LINE__ << "\n"
 
+// Per-test-case profiling (compile with -DLOCAL -DPROFILE)
+// Records wall time, TSC cycles and peak RSS growth of every case and
+// prints a percentile summary to stderr at exit
+#ifdef PROFILE
+namespace dbg_internal {
+
+inline uint64_t read_cycles() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+inline long peak_rss_kb() {
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+struct case_profiler {
+    struct sample {
+        double ms;
+        uint64_t cycles;
+        long rss_kb;
+    };
+
+    std::vector<sample> samples;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    static case_profiler& instance() {
+        static case_profiler profiler;
+        return profiler;
+    }
+
+    template<typename F>
+    void run(F&& f) {
+        const long rss0 = peak_rss_kb();
+        const uint64_t c0 = read_cycles();
+        const auto t0 = std::chrono::steady_clock::now();
+
+        f();
+
+        const auto t1 = std::chrono::steady_clock::now();
+        const uint64_t c1 = read_cycles();
+        samples.push_back({std::chrono::duration<double, std::milli>(t1 - t0).count(),
+                           c1 - c0, peak_rss_kb() - rss0});
+    }
+
+    ~case_profiler() {
+        if (samples.empty()) return;
+
+        const size_t n = samples.size();
+        const double total_ms = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start).count();
+
+        std::vector<double> ms(n);
+        size_t slowest = 0;
+        long rss_total = 0;
+        for (size_t i = 0; i < n; ++i) {
+            ms[i] = samples[i].ms;
+            rss_total += samples[i].rss_kb;
+            if (samples[i].ms > samples[slowest].ms) slowest = i;
+        }
+        std::ranges::sort(ms);
+        auto pct = [&](double q) { return ms[std::min(n - 1, static_cast<size_t>(q * (n - 1) + 0.5))]; };
+
+        std::ostringstream oss;
+        oss.setf(std::ios::fixed);
+        oss.precision(3);
+        oss << DBG_CYAN << "[profile]" << DBG_RESET << " "
+            << n << " cases in " << total_ms << " ms ("
+            << (total_ms > 0 ? 1000.0 * n / total_ms : 0.0) << " cases/s)\n"
+            << DBG_CYAN << "[profile]" << DBG_RESET << " "
+            << "p50 = " << pct(0.50) << " ms, p99 = " << pct(0.99) << " ms, max = " << ms.back() << " ms\n"
+            << DBG_CYAN << "[profile]" << DBG_RESET << " "
+            << DBG_YELLOW << "slowest case #" << slowest + 1 << DBG_RESET
+            << ": " << samples[slowest].cycles << " cycles, peak RSS +" << samples[slowest].rss_kb << " KiB"
+            << " (total peak RSS growth " << rss_total << " KiB)\n";
+        std::cerr << oss.str();
+    }
+};
+
+}
+
+#define debug_case(f) dbg_internal::case_profiler::instance().run(f)
+#else
+#define debug_case(f) f()
+#endif
+
 #endif
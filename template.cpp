@@ -5,13 +5,18 @@ using namespace std;
 #include "debug.h"
 #else
 #define debug(...) 42
+#define debug_case(f) f()
 #endif
 
 #define int long long
 #define endl "\n"
 
 constexpr int INF = 1e18;
-constexpr int MOD = 1e9 + 7;
+// Select another modulus at compile time with -DMODULUS=998244353
+#ifndef MODULUS
+#define MODULUS 1000000007
+#endif
+constexpr int MOD = MODULUS;
 
 mt19937_64 rng(chrono::steady_clock::now().time_since_epoch().count());
 
@@ -21,14 +26,37 @@ void solve() {
 }
 
 
+// Modes, selected with -D flags (or #define above the includes):
+//   SINGLE_TEST      no test count in the input, solve() runs once
+//   INTERACTIVE      cin is tied to cout, so queries are flushed before each read
+//   FILE_IO="name"   read name.in and write name.out instead of stdin / stdout
+//                    (from a shell: -DFILE_IO='"name"')
+//   PIPELINED        threaded read-ahead / write-behind (paste pipelined_io from snippets/io.md)
+#if defined(INTERACTIVE) && (defined(FILE_IO) || defined(PIPELINED))
+#error "INTERACTIVE talks to the judge over stdin / stdout and cannot be combined with FILE_IO or PIPELINED"
+#endif
+
 int32_t main() {
+#ifdef FILE_IO
+    if (!freopen(FILE_IO ".in", "r", stdin) || !freopen(FILE_IO ".out", "w", stdout)) return 1;
+#endif
+#ifdef PIPELINED
+    pipelined_io io;
+#else
     ios::sync_with_stdio(false);
+#endif
+#ifdef INTERACTIVE
+    cin.tie(&cout);  // flushes pending queries exactly when the next reply is read
+#else
     cin.tie(nullptr);
+#endif
 
     int t = 1;
+#ifndef SINGLE_TEST
     cin >> t;
+#endif
     while (t--) {
-        solve();
+        debug_case(solve);
     }
 
     return 0;
@@ -0,0 +1,117 @@
+// Benchmark runner: builds each program in bench/ against the snippets it
+// names and appends its output to bench_output.txt.
+//
+// Build:  g++ -std=c++20 -O2 -pthread tools/bench.cpp -o bench
+// Usage:  ./bench <bench/name.cpp>... [-f flags]
+//   -f <flags>   extra compiler flags, e.g. -f "-march=native"
+//
+// A benchmark lists the snippet sections it needs in comment lines
+//     // snippet: optimization.md Linear Programming
+// (file under snippets/, then a prefix of the "## " section title) and
+// includes "snippets.h", which holds the template prelude (template.cpp up
+// to solve()) followed by those sections in order.
+#include "process.h"
+using namespace std;
+using namespace tools;
+
+[[nodiscard]]
+string read_file(const fs::path& path) {
+    ifstream f(path);
+    if (!f) {
+        cerr << "[bench] cannot read " << path << "\n";
+        exit(1);
+    }
+    return string(istreambuf_iterator<char>(f), istreambuf_iterator<char>());
+}
+
+// Nearest ancestor of p holding template.cpp and snippets/
+[[nodiscard]]
+fs::path find_root(fs::path p) {
+    for (p = fs::absolute(p).parent_path(); !p.empty(); p = p.parent_path()) {
+        if (fs::exists(p / "template.cpp") && fs::is_directory(p / "snippets")) return p;
+        if (p == p.root_path()) break;
+    }
+    cerr << "[bench] no repository root above the benchmark\n";
+    exit(1);
+}
+
+// Code blocks of the first section of file whose title starts with title
+[[nodiscard]]
+string section_code(const fs::path& file, const string& title) {
+    istringstream in(read_file(file));
+    string line, code;
+    bool in_section = false, found = false, in_code = false;
+    while (getline(in, line)) {
+        if (line.starts_with("## ")) {
+            if (found) break;
+            in_section = found = line.substr(3).starts_with(title);
+        } else if (in_section && line.starts_with("```")) {
+            in_code = !in_code;
+        } else if (in_code) {
+            code += line + "\n";
+        }
+    }
+    if (!found) {
+        cerr << "[bench] no section \"" << title << "\" in " << file << "\n";
+        exit(1);
+    }
+    return code;
+}
+
+// template.cpp up to solve(), then the requested sections
+[[nodiscard]]
+string snippets_header(const fs::path& bench, const fs::path& root) {
+    const string tmpl = read_file(root / "template.cpp");
+    string res = tmpl.substr(0, tmpl.find("void solve()"));
+
+    istringstream in(read_file(bench));
+    const string tag = "// snippet: ";
+    for (string line; getline(in, line);) {
+        if (!line.starts_with(tag)) continue;
+        const string spec = line.substr(tag.size());
+        const size_t sp = spec.find(' ');
+        const string file = spec.substr(0, sp), title = sp == string::npos ? "" : spec.substr(sp + 1);
+        res += "\n// " + file + ": " + title + "\n" + section_code(root / "snippets" / file, title);
+    }
+    return res;
+}
+
+int main(int argc, char** argv) {
+    vector<string> benches;
+    string flags;
+    for (int i = 1; i < argc; ++i) {
+        const string arg = argv[i];
+        if (arg == "-f") {
+            if (i + 1 == argc) {
+                cerr << "missing value for option -f\n";
+                return 2;
+            }
+            flags = argv[++i];
+        } else {
+            benches.push_back(arg);
+        }
+    }
+    if (benches.empty()) {
+        cerr << "usage: " << argv[0] << " <bench/name.cpp>... [-f flags]\n";
+        return 2;
+    }
+
+    const fs::path work = make_work_dir("bench");
+    ofstream report("bench_output.txt", ios::app);
+    int failed = 0;
+    for (const auto& b : benches) {
+        const fs::path dir = work / fs::path(b).stem();
+        fs::create_directories(dir);
+        ofstream(dir / "snippets.h") << snippets_header(b, find_root(b));
+        const string binary = compile_if_source(b, dir, flags + " -I'" + dir.string() + "'");
+
+        const auto res = run_piped(binary, {}, "", 3600);
+        const string head = "== " + b + (res.ok() ? "" : " [failed]") + "\n";
+        cout << head << res.out << flush;
+        report << head << res.out;
+        failed += !res.ok();
+    }
+
+    fs::remove_all(work);
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,287 @@
+// Random test-data generators for stress testing (see tools/stress.cpp)
+//
+// Include before `#define int long long`. Typical generator:
+//
+//     #include "gen.h"
+//     int main(int argc, char** argv) {
+//         gen::seed(argc, argv);
+//         const int n = gen::uniform(2, 10);
+//         gen::out.write(n, '\n');
+//         gen::out.write_edges(gen::shuffled(gen::prufer_tree(n), n));
+//     }
+//
+// Vertices are 0-based internally and written 1-based.
+#ifndef TOOLS_GEN_H
+#define TOOLS_GEN_H
+
+#include <bits/stdc++.h>
+
+namespace gen {
+
+using edges = std::vector<std::pair<int, int>>;
+
+inline std::mt19937_64 rng(1);
+
+// Seeds rng from argv[1] (as passed by tools/stress.cpp), or 1 if absent
+inline void seed(int argc, char** argv) {
+    rng.seed(argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1);
+}
+
+// Uniform in [0, s) without modulo bias (Lemire's multiply-shift method)
+// The slow path with a division runs with probability < s / 2^64
+[[nodiscard]]
+inline uint64_t below(uint64_t s) {
+    __uint128_t m = (__uint128_t)rng() * s;
+    uint64_t low = (uint64_t)m;
+    if (low < s) {
+        const uint64_t threshold = -s % s;
+        while (low < threshold) {
+            m = (__uint128_t)rng() * s;
+            low = (uint64_t)m;
+        }
+    }
+    return m >> 64;
+}
+
+// Uniform in [l, r]
+[[nodiscard]]
+inline long long uniform(long long l, long long r) {
+    const uint64_t span = (uint64_t)r - (uint64_t)l + 1;
+    return span == 0 ? (long long)rng() : l + (long long)below(span);
+}
+
+template<typename T>
+void shuffle(std::vector<T>& a) {
+    for (int i = ssize(a) - 1; i > 0; --i) std::swap(a[i], a[below(i + 1)]);
+}
+
+// Uniformly random permutation of 0..n-1
+[[nodiscard]]
+inline std::vector<int> permutation(int n) {
+    std::vector<int> p(n);
+    std::iota(p.begin(), p.end(), 0);
+    shuffle(p);
+    return p;
+}
+
+// Random string of length n over alphabet
+[[nodiscard]]
+inline std::string random_string(int n, std::string_view alphabet = "abcdefghijklmnopqrstuvwxyz") {
+    std::string s(n, ' ');
+    for (auto& c : s) c = alphabet[below(alphabet.size())];
+    return s;
+}
+
+// Uniformly random labeled tree, decoded from a random Prüfer code
+// Time: O(n)
+[[nodiscard]]
+inline edges prufer_tree(int n) {
+    edges res;
+    if (n < 2) return res;
+    res.reserve(n - 1);
+
+    std::vector<int> code(n - 2), degree(n, 1);
+    for (auto& v : code) ++degree[v = below(n)];
+
+    int ptr = 0;
+    while (degree[ptr] != 1) ++ptr;
+    int leaf = ptr;
+    for (const int v : code) {
+        res.emplace_back(leaf, v);
+        if (--degree[v] == 1 && v < ptr) {
+            leaf = v;
+        } else {
+            while (degree[++ptr] != 1) {}
+            leaf = ptr;
+        }
+    }
+    res.emplace_back(leaf, n - 1);
+    return res;
+}
+
+// Random recursive tree: parent of i is uniform in [max(0, i - depth_bias), i)
+// depth_bias = 1 gives a path, n gives O(log n) expected depth
+[[nodiscard]]
+inline edges recursive_tree(int n, int depth_bias = INT_MAX) {
+    edges res;
+    res.reserve(std::max(n - 1, 0));
+    for (int i = 1; i < n; ++i) {
+        const int lo = std::max(0, i - depth_bias);
+        res.emplace_back(lo + (int)below(i - lo), i);
+    }
+    return res;
+}
+
+// Path 0 - 1 - ... - (spine - 1) with every other vertex hanging off a random spine vertex
+[[nodiscard]]
+inline edges caterpillar(int n, int spine) {
+    spine = std::clamp(spine, std::min(n, 1), n);
+    edges res;
+    res.reserve(std::max(n - 1, 0));
+    for (int i = 1; i < spine; ++i) res.emplace_back(i - 1, i);
+    for (int i = spine; i < n; ++i) res.emplace_back((int)below(spine), i);
+    return res;
+}
+
+[[nodiscard]]
+inline edges star(int n, int center = 0) {
+    edges res;
+    for (int i = 0; i < n; ++i) {
+        if (i != center) res.emplace_back(center, i);
+    }
+    return res;
+}
+
+// Random binary tree rooted at 0: each new vertex fills a uniformly random free child slot
+[[nodiscard]]
+inline edges binary_tree(int n) {
+    edges res;
+    res.reserve(std::max(n - 1, 0));
+    std::vector<int> slots;
+    slots.reserve(n + 1);
+    if (n > 0) slots = {0, 0};
+    for (int i = 1; i < n; ++i) {
+        const int k = below(slots.size());
+        res.emplace_back(slots[k], i);
+        slots[k] = slots.back();
+        slots.back() = i;
+        slots.push_back(i);
+    }
+    return res;
+}
+
+// m distinct unordered pairs {u, v}, u != v, accepted by ok(u, v), on top of
+// seed_edges; allowed is the number of pairs ok accepts (seeds included)
+// Rejection sampling while sparse, explicit enumeration when dense
+template<typename F>
+[[nodiscard]] edges distinct_pairs(int n, long long m, long long allowed, F&& ok, edges seed_edges = {}) {
+    const long long available = allowed - ssize(seed_edges);
+    assert(m <= available && "more edges requested than the graph class allows");
+    std::unordered_set<uint64_t> used;
+    used.reserve(2 * (m + seed_edges.size()));
+    auto key = [&](int u, int v) { return (uint64_t)std::min(u, v) * n + std::max(u, v); };
+    for (const auto& [u, v] : seed_edges) used.insert(key(u, v));
+
+    edges res = std::move(seed_edges);
+    if (2 * m > available) {
+        edges all;
+        all.reserve(available);
+        for (int u = 0; u < n; ++u) {
+            for (int v = u + 1; v < n; ++v) {
+                if (ok(u, v) && !used.count(key(u, v))) all.emplace_back(u, v);
+            }
+        }
+        shuffle(all);
+        all.resize(std::max(m, 0LL));
+        res.insert(res.end(), all.begin(), all.end());
+        return res;
+    }
+
+    for (long long added = 0; added < m;) {
+        const int u = below(n), v = below(n);
+        if (u == v || !ok(u, v) || !used.insert(key(u, v)).second) continue;
+        res.emplace_back(u, v);
+        ++added;
+    }
+    return res;
+}
+
+// Connected simple graph with n vertices and m >= n - 1 edges
+[[nodiscard]]
+inline edges connected_graph(int n, long long m) {
+    auto tree = prufer_tree(n);
+    return distinct_pairs(n, m - (n - 1), (long long)n * (n - 1) / 2, [](int, int) { return true; }, std::move(tree));
+}
+
+// DAG with m distinct edges; every edge goes forward in a hidden random topological order
+[[nodiscard]]
+inline edges dag(int n, long long m) {
+    const auto order = permutation(n);
+    auto res = distinct_pairs(n, m, (long long)n * (n - 1) / 2, [](int, int) { return true; });
+    for (auto& [u, v] : res) {
+        if (u > v) std::swap(u, v);
+        u = order[u];
+        v = order[v];
+    }
+    return res;
+}
+
+// Bipartite graph with parts [0, n1) and [n1, n1 + n2) and m distinct edges
+[[nodiscard]]
+inline edges bipartite(int n1, int n2, long long m) {
+    auto res = distinct_pairs(n1 + n2, m, (long long)n1 * n2, [&](int u, int v) { return (u < n1) != (v < n1); });
+    for (auto& [u, v] : res) {
+        if (u > v) std::swap(u, v);
+    }
+    return res;
+}
+
+// Random relabeling of vertices, edge order and edge direction
+[[nodiscard]]
+inline edges shuffled(edges es, int n) {
+    const auto p = permutation(n);
+    for (auto& [u, v] : es) {
+        u = p[u];
+        v = p[v];
+        if (below(2)) std::swap(u, v);
+    }
+    shuffle(es);
+    return es;
+}
+
+// Buffered stdout writer; flushes when the buffer fills and at exit
+struct writer {
+    static constexpr int SIZE = 1 << 16;
+    char buf[SIZE];
+    int pos = 0;
+
+    ~writer() { flush(); }
+
+    void flush() {
+        fwrite(buf, 1, pos, stdout);
+        pos = 0;
+    }
+
+    void put(char c) {
+        if (pos == SIZE) flush();
+        buf[pos++] = c;
+    }
+
+    void put(std::string_view s) {
+        for (const char c : s) put(c);
+    }
+
+    template<std::integral T>
+    void put(T x) {
+        if (pos + 24 > SIZE) flush();
+        pos = std::to_chars(buf + pos, buf + SIZE, x).ptr - buf;
+    }
+
+    void put(const std::string& s) { put(std::string_view(s)); }
+    void put(const char* s) { put(std::string_view(s)); }
+
+    // Writes every argument with no separators, e.g. write(n, ' ', m, '\n')
+    template<typename... Args>
+    void write(const Args&... args) { (put(args), ...); }
+
+    // Space-separated values followed by a newline
+    template<typename T>
+    void write_line(const std::vector<T>& a, int offset = 0) {
+        for (size_t i = 0; i < a.size(); ++i) {
+            if (i) put(' ');
+            put(a[i] + offset);
+        }
+        put('\n');
+    }
+
+    // One "u v" line per edge, 1-based
+    void write_edges(const edges& es) {
+        for (const auto& [u, v] : es) write(u + 1, ' ', v + 1, '\n');
+    }
+};
+
+inline writer out;
+
+}
+
+#endif
@@ -0,0 +1,173 @@
+// Local interactor harness: connects a solution and an interactor through
+// pipes, relaying every byte so it can count queries and time each turn.
+//
+// Build:  g++ -std=c++20 -O2 tools/interact.cpp -o interact
+// Usage:  ./interact <interactor> <solution> [options]   (each a .cpp file or a binary)
+//   -i <file>    test input, passed to the interactor as argv[1]
+//   -t <sec>     wall-clock limit for the whole session (default 10)
+//   -l           log the transcript to stderr ("> " solution, "< " interactor)
+//   -f <flags>   extra compiler flags, e.g. -f "-DINTERACTIVE"
+//
+// The interactor's exit code is the verdict (0 = accepted, as with testlib).
+// Reported latencies: "judge" is the time from the solution's last byte to
+// the interactor's first reply, "solution" the converse. "writes/query"
+// near 1 means the solution flushes once per query.
+#include "process.h"
+using namespace std;
+using namespace tools;
+
+struct turn_stats {
+    vector<double> us;
+
+    void add(double v) { us.push_back(v); }
+
+    [[nodiscard]]
+    string summary() {
+        if (us.empty()) return "-";
+        ranges::sort(us);
+        const double mean = accumulate(us.begin(), us.end(), 0.0) / us.size();
+        ostringstream oss;
+        oss << fixed << setprecision(1) << "mean " << mean << " us, p50 " << us[us.size() / 2]
+            << " us, p99 " << us[min(us.size() - 1, us.size() * 99 / 100)] << " us, max " << us.back() << " us";
+        return oss.str();
+    }
+};
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        cerr << "usage: " << argv[0] << " <interactor> <solution> [-i input] [-t sec] [-l] [-f flags]\n";
+        return 2;
+    }
+    signal(SIGPIPE, SIG_IGN);
+
+    string input, flags;
+    double timeout = 10;
+    bool log = false;
+    for (int i = 3; i < argc; ++i) {
+        const string flag = argv[i];
+        if (flag == "-l") {
+            log = true;
+            continue;
+        }
+        if (i + 1 == argc) {
+            cerr << "missing value for option " << flag << "\n";
+            return 2;
+        }
+        if (flag == "-i") input = fs::absolute(argv[++i]).string();
+        else if (flag == "-t") timeout = stod(argv[++i]);
+        else if (flag == "-f") flags = argv[++i];
+        else {
+            cerr << "unknown option " << flag << "\n";
+            return 2;
+        }
+    }
+
+    const fs::path work = make_work_dir("interact");
+    fs::create_directories(work / "interactor");
+    fs::create_directories(work / "solution");
+    const string interactor = compile_if_source(argv[1], work / "interactor", flags);
+    const string solution = compile_if_source(argv[2], work / "solution", flags);
+
+    // sol_in/sol_out: solution's stdin/stdout; int_in/int_out: interactor's
+    int sol_in[2], sol_out[2], int_in[2], int_out[2];
+    if (pipe(sol_in) || pipe(sol_out) || pipe(int_in) || pipe(int_out)) {
+        perror("pipe");
+        return 1;
+    }
+    const pid_t int_pid = spawn(interactor, input.empty() ? vector<string>{} : vector<string>{input},
+                                int_in[0], int_out[1], -1);
+    const pid_t sol_pid = spawn(solution, {}, sol_in[0], sol_out[1], -1);
+    close(sol_in[0]); close(sol_out[1]); close(int_in[0]); close(int_out[1]);
+
+    using clock = chrono::steady_clock;
+    const auto t0 = clock::now();
+    auto last_sol = t0, last_int = t0;
+    enum { NONE, SOL, INT } last = NONE;
+
+    turn_stats judge_lat, sol_lat;
+    long long queries = 0, sol_writes = 0, bytes = 0;
+    bool sol_open = true, int_open = true, timed_out = false;
+    char buf[1 << 16];
+
+    auto forward = [&](int fd, const char* data, ssize_t n) {
+        for (ssize_t done = 0; done < n;) {
+            const ssize_t w = write(fd, data + done, n - done);
+            if (w <= 0) return;
+            done += w;
+        }
+    };
+
+    while (sol_open || int_open) {
+        if (chrono::duration<double>(clock::now() - t0).count() > timeout) {
+            timed_out = true;
+            kill(sol_pid, SIGKILL);
+            kill(int_pid, SIGKILL);
+            break;
+        }
+
+        pollfd fds[2] = {{sol_open ? sol_out[0] : -1, POLLIN, 0}, {int_open ? int_out[0] : -1, POLLIN, 0}};
+        if (poll(fds, 2, 50) <= 0) continue;
+
+        if (fds[0].revents & (POLLIN | POLLHUP | POLLERR)) {
+            const ssize_t r = read(sol_out[0], buf, sizeof(buf));
+            const auto now = clock::now();
+            if (r <= 0) {
+                sol_open = false;
+                close(int_in[1]);
+            } else {
+                if (last == INT) sol_lat.add(chrono::duration<double, micro>(now - last_int).count());
+                last = SOL;
+                last_sol = now;
+                ++sol_writes;
+                bytes += r;
+                queries += count(buf, buf + r, '\n');
+                if (log) cerr << "> " << string_view(buf, r) << flush;
+                forward(int_in[1], buf, r);
+            }
+        }
+        if (fds[1].revents & (POLLIN | POLLHUP | POLLERR)) {
+            const ssize_t r = read(int_out[0], buf, sizeof(buf));
+            const auto now = clock::now();
+            if (r <= 0) {
+                int_open = false;
+                close(sol_in[1]);
+            } else {
+                if (last == SOL) judge_lat.add(chrono::duration<double, micro>(now - last_sol).count());
+                last = INT;
+                last_int = now;
+                bytes += r;
+                if (log) cerr << "< " << string_view(buf, r) << flush;
+                forward(sol_in[1], buf, r);
+            }
+        }
+    }
+    if (sol_open) close(int_in[1]);
+    if (int_open) close(sol_in[1]);
+
+    int sol_status = 0, int_status = 0;
+    waitpid(sol_pid, &sol_status, 0);
+    waitpid(int_pid, &int_status, 0);
+    const double total_ms = chrono::duration<double, milli>(clock::now() - t0).count();
+
+    // The interactor decides first: a solution that dies after a wrong
+    // answer is WA, and RE only when the interactor accepted or was cut off.
+    // Our own SIGKILL at the time limit does not count as a crash
+    const bool sol_failed = WIFEXITED(sol_status) ? WEXITSTATUS(sol_status) != 0
+                                                  : !(timed_out && WTERMSIG(sol_status) == SIGKILL);
+    string verdict;
+    if (timed_out) verdict = sol_failed ? "RE (solution)" : "TLE";
+    else if (!WIFEXITED(int_status)) verdict = "FAIL (interactor crashed)";
+    else if (WEXITSTATUS(int_status) != 0) verdict = "WA (interactor exit " + to_string(WEXITSTATUS(int_status)) + ")";
+    else if (sol_failed) verdict = "RE (solution)";
+    else verdict = "OK";
+
+    cout << "[interact] " << verdict << " in " << fixed << setprecision(1) << total_ms << " ms\n"
+         << "[interact] " << queries << " queries, " << sol_writes << " solution writes ("
+         << setprecision(2) << (queries ? (double)sol_writes / queries : 0.0) << " writes/query), "
+         << bytes << " bytes\n"
+         << "[interact] judge latency:    " << judge_lat.summary() << "\n"
+         << "[interact] solution latency: " << sol_lat.summary() << "\n";
+
+    fs::remove_all(work);
+    return verdict == "OK" ? 0 : 1;
+}
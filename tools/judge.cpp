@@ -0,0 +1,216 @@
+// Local judge: compiles a solution and runs it against every <name>.in in a
+// directory, comparing with <name>.ans (or <name>.out) under CPU-time and
+// address-space rlimits, several tests in parallel.
+//
+// Build:  g++ -std=c++20 -O2 -pthread tools/judge.cpp -o judge
+// Usage:  ./judge <solution.cpp | binary> <tests-dir> [options]
+//   -t <sec>     time limit per test (default 2)
+//   -m <MiB>     memory limit per test (default 256, 0 for none)
+//   -e <eps>     accept numeric tokens within absolute or relative error eps
+//   -j <n>       parallel jobs (default: number of cores)
+//   -f <flags>   extra compiler flags, e.g. -f "-DLOCAL -fsanitize=address"
+//                (sanitizers reserve terabytes of shadow address space, so
+//                -fsanitize turns the memory limit off)
+//
+// A summary is also written to test_output.txt in the working directory.
+#include "process.h"
+using namespace std;
+using namespace tools;
+
+struct options {
+    double time_limit = 2.0;
+    long memory_mb = 256;
+    double eps = -1;
+    int jobs = max(1u, thread::hardware_concurrency());
+    string cxx_flags;
+};
+
+struct run_result {
+    int status = 0;
+    double cpu_ms = 0, wall_ms = 0;
+    long rss_kb = 0;
+    bool wall_killed = false;
+};
+
+struct verdict {
+    string name, code, detail;
+    run_result run;
+};
+
+// Runs argv[0] with stdin/stdout/stderr redirected under the given limits
+// A wall-clock watchdog kills the child after 3x the time limit so that
+// sleeping or blocked solutions cannot hang the judge
+[[nodiscard]]
+run_result run_limited(const vector<string>& argv, const string& in, const string& out,
+                       const string& err, double time_limit, long memory_mb) {
+    // argv is built before fork(): the child of a multithreaded process may
+    // only call async-signal-safe functions, and malloc is not one of them
+    vector<char*> args;
+    for (const auto& a : argv) args.push_back(const_cast<char*>(a.c_str()));
+    args.push_back(nullptr);
+
+    const auto t0 = chrono::steady_clock::now();
+    const pid_t pid = fork();
+    if (pid == 0) {
+        const int fin = open(in.c_str(), O_RDONLY);
+        const int fout = open(out.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        const int ferr = open(err.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fin < 0 || fout < 0 || ferr < 0) _exit(127);
+        dup2(fin, 0); dup2(fout, 1); dup2(ferr, 2);
+
+        const rlim_t cpu = (rlim_t)ceil(time_limit) + 1;
+        const rlimit cpu_lim{cpu, cpu + 1};
+        setrlimit(RLIMIT_CPU, &cpu_lim);
+        if (memory_mb > 0) {
+            const rlimit mem_lim{(rlim_t)memory_mb << 20, (rlim_t)memory_mb << 20};
+            setrlimit(RLIMIT_AS, &mem_lim);
+            setrlimit(RLIMIT_STACK, &mem_lim);
+        }
+
+        execv(args[0], args.data());
+        _exit(127);
+    }
+
+    run_result res;
+    rusage usage{};
+    while (true) {
+        const pid_t r = wait4(pid, &res.status, WNOHANG, &usage);
+        if (r == pid) break;
+        const double elapsed = chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+        if (!res.wall_killed && elapsed > 3 * time_limit + 1) {
+            kill(pid, SIGKILL);
+            res.wall_killed = true;
+        }
+        this_thread::sleep_for(chrono::microseconds(500));
+    }
+
+    res.wall_ms = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+    res.cpu_ms = (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1e3 +
+                 (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e3;
+    res.rss_kb = usage.ru_maxrss;
+    return res;
+}
+
+[[nodiscard]]
+string read_file(const string& path) {
+    ifstream f(path);
+    return string(istreambuf_iterator<char>(f), istreambuf_iterator<char>());
+}
+
+[[nodiscard]]
+verdict judge_one(const string& binary, const fs::path& in, const fs::path& work, const options& opt) {
+    verdict v;
+    v.name = in.stem().string();
+
+    fs::path ans = in;
+    ans.replace_extension(".ans");
+    if (!fs::exists(ans)) ans.replace_extension(".out");
+
+    const string out = (work / (v.name + ".out")).string();
+    const string err = (work / (v.name + ".err")).string();
+    v.run = run_limited({binary}, in.string(), out, err, opt.time_limit, opt.memory_mb);
+    const auto& r = v.run;
+
+    // Allocation failures under RLIMIT_AS surface as bad_alloc long before RSS reaches the limit
+    const bool near_memory = (opt.memory_mb > 0 && r.rss_kb >= opt.memory_mb * 1024 * 9 / 10) ||
+                             read_file(err).find("bad_alloc") != string::npos;
+    if (r.wall_killed || r.cpu_ms > opt.time_limit * 1000 ||
+        (WIFSIGNALED(r.status) && WTERMSIG(r.status) == SIGXCPU)) {
+        v.code = "TLE";
+    } else if (WIFSIGNALED(r.status) || (WIFEXITED(r.status) && WEXITSTATUS(r.status) != 0)) {
+        v.code = near_memory ? "MLE" : "RE";
+        v.detail = WIFSIGNALED(r.status) ? string("signal ") + strsignal(WTERMSIG(r.status))
+                                         : "exit code " + to_string(WEXITSTATUS(r.status));
+    } else if (!fs::exists(ans)) {
+        v.code = "OK";
+        v.detail = "no answer file";
+    } else {
+        v.detail = compare_tokens(read_file(out), read_file(ans.string()), opt.eps);
+        v.code = v.detail.empty() ? "AC" : "WA";
+    }
+    return v;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        cerr << "usage: " << argv[0] << " <solution.cpp | binary> <tests-dir> "
+             << "[-t sec] [-m MiB] [-e eps] [-j jobs] [-f flags]\n";
+        return 2;
+    }
+
+    options opt;
+    for (int i = 3; i < argc; i += 2) {
+        if (i + 1 == argc) {
+            cerr << "missing value for option " << argv[i] << "\n";
+            return 2;
+        }
+        const string flag = argv[i], val = argv[i + 1];
+        if (flag == "-t") opt.time_limit = stod(val);
+        else if (flag == "-m") opt.memory_mb = stol(val);
+        else if (flag == "-e") opt.eps = stod(val);
+        else if (flag == "-j") opt.jobs = max(1, stoi(val));
+        else if (flag == "-f") opt.cxx_flags = val;
+        else {
+            cerr << "unknown option " << flag << "\n";
+            return 2;
+        }
+    }
+
+    if (opt.memory_mb > 0 && opt.cxx_flags.find("-fsanitize") != string::npos) {
+        cerr << "[judge] -fsanitize needs an unlimited address space; memory limit disabled\n";
+        opt.memory_mb = 0;
+    }
+
+    const fs::path work = make_work_dir("judge");
+    const string binary = compile_if_source(argv[1], work, opt.cxx_flags);
+
+    vector<fs::path> tests;
+    for (const auto& e : fs::directory_iterator(argv[2])) {
+        if (e.path().extension() == ".in") tests.push_back(e.path());
+    }
+    ranges::sort(tests, [](const fs::path& a, const fs::path& b) {
+        const string x = a.stem().string(), y = b.stem().string();
+        return x.size() != y.size() ? x.size() < y.size() : x < y;
+    });
+
+    const int n = ssize(tests);
+    vector<verdict> res(n);
+    atomic<int> next = 0;
+    mutex print_lock;
+    const bool color = isatty(1);
+
+    auto worker = [&] {
+        for (int i; (i = next++) < n;) {
+            res[i] = judge_one(binary, tests[i], work, opt);
+            const auto& v = res[i];
+            const char* c = !color ? "" : (v.code == "AC" || v.code == "OK") ? "\033[32m" : "\033[31m";
+            lock_guard lock(print_lock);
+            printf("%s%-4s%s %-24s %8.0f ms %8.1f MiB  %s\n", c, v.code.c_str(), color ? "\033[0m" : "",
+                   v.name.c_str(), v.run.cpu_ms, v.run.rss_kb / 1024.0, v.detail.c_str());
+            fflush(stdout);
+        }
+    };
+    vector<thread> pool;
+    for (int j = 0; j < min(opt.jobs, max(n, 1)); ++j) pool.emplace_back(worker);
+    for (auto& th : pool) th.join();
+
+    int passed = 0;
+    double max_ms = 0;
+    long max_kb = 0;
+    ofstream report("test_output.txt");
+    for (const auto& v : res) {
+        passed += v.code == "AC" || v.code == "OK";
+        max_ms = max(max_ms, v.run.cpu_ms);
+        max_kb = max(max_kb, v.run.rss_kb);
+        report << v.code << " " << v.name << " " << fixed << setprecision(0) << v.run.cpu_ms << "ms "
+               << setprecision(1) << v.run.rss_kb / 1024.0 << "MiB " << v.detail << "\n";
+    }
+    ostringstream summary;
+    summary << passed << "/" << n << " passed, max time " << fixed << setprecision(0) << max_ms
+            << " ms, max memory " << setprecision(1) << max_kb / 1024.0 << " MiB";
+    report << summary.str() << "\n";
+    printf("%s\n", summary.str().c_str());
+
+    fs::remove_all(work);
+    return passed == n ? 0 : 1;
+}
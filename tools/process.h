@@ -0,0 +1,173 @@
+// Process helpers shared by the local tools (judge, stress, interactor)
+#ifndef TOOLS_PROCESS_H
+#define TOOLS_PROCESS_H
+
+#include <bits/stdc++.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace tools {
+
+namespace fs = std::filesystem;
+
+// Compiles path into work/<stem> if it is a .cpp file, otherwise returns it
+// unchanged; exits the tool on compilation failure
+[[nodiscard]]
+inline std::string compile_if_source(const std::string& path, const fs::path& work, const std::string& flags) {
+    const fs::path src = fs::absolute(path);
+    if (src.extension() != ".cpp") return src.string();
+
+    const std::string exe = (work / src.stem()).string();
+    const std::string cmd = "g++ -std=c++20 -O2 -pipe " + flags + " '" + src.string() + "' -o '" + exe + "'";
+    std::cerr << "[tools] " << cmd << "\n";
+    if (std::system(cmd.c_str()) != 0) {
+        std::cerr << "[tools] compilation of " << path << " failed\n";
+        std::exit(1);
+    }
+    return exe;
+}
+
+[[nodiscard]]
+inline fs::path make_work_dir(const char* name) {
+    std::string tmpl = std::string("/tmp/") + name + ".XXXXXX";
+    if (!mkdtemp(tmpl.data())) {
+        perror("[tools] mkdtemp");
+        std::exit(1);
+    }
+    return tmpl;
+}
+
+struct piped_result {
+    int status = 0;
+    std::string out;
+    double wall_ms = 0;
+    bool timed_out = false;
+
+    [[nodiscard]] bool ok() const { return !timed_out && WIFEXITED(status) && WEXITSTATUS(status) == 0; }
+};
+
+// Starts binary with args and the given descriptors as stdin/stdout/stderr
+// (-1 keeps the parent's); every other descriptor is closed in the child
+inline pid_t spawn(const std::string& binary, const std::vector<std::string>& args,
+                   int in, int out, int err) {
+    // Built before fork(): callers are multithreaded and malloc is not async-signal-safe
+    std::vector<char*> argv{const_cast<char*>(binary.c_str())};
+    for (const auto& a : args) argv.push_back(const_cast<char*>(a.c_str()));
+    argv.push_back(nullptr);
+
+    const pid_t pid = fork();
+    if (pid == 0) {
+        if (in >= 0) dup2(in, 0);
+        if (out >= 0) dup2(out, 1);
+        if (err >= 0) dup2(err, 2);
+        for (int fd = 3; fd < 1024; ++fd) close(fd);
+        execv(argv[0], argv.data());
+        _exit(127);
+    }
+    return pid;
+}
+
+// Runs binary with args, feeding input on stdin and capturing stdout
+// stderr is discarded; the child is killed after timeout seconds
+[[nodiscard]]
+inline piped_result run_piped(const std::string& binary, const std::vector<std::string>& args,
+                              const std::string& input, double timeout) {
+    // O_CLOEXEC: other threads fork concurrently, and a child that inherits
+    // this write end would keep the pipe open and delay EOF
+    int in_pipe[2], out_pipe[2];
+    if (pipe2(in_pipe, O_CLOEXEC) != 0 || pipe2(out_pipe, O_CLOEXEC) != 0) {
+        perror("pipe");
+        std::exit(1);
+    }
+
+    const auto t0 = std::chrono::steady_clock::now();
+    const int fnull = open("/dev/null", O_WRONLY | O_CLOEXEC);
+    const pid_t pid = spawn(binary, args, in_pipe[0], out_pipe[1], fnull);
+    if (fnull >= 0) close(fnull);
+    close(in_pipe[0]);
+    close(out_pipe[1]);
+
+    // Interleave writing input and draining output so neither pipe fills up
+    piped_result res;
+    size_t written = 0;
+    int wfd = in_pipe[1];
+    if (input.empty()) {
+        close(wfd);
+        wfd = -1;
+    }
+    char buf[1 << 16];
+    while (true) {
+        pollfd fds[2] = {{out_pipe[0], POLLIN, 0}, {wfd, POLLOUT, 0}};
+        const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        if (elapsed > timeout) {
+            kill(pid, SIGKILL);
+            res.timed_out = true;
+            break;
+        }
+        if (poll(fds, wfd >= 0 ? 2 : 1, 10) < 0 && errno != EINTR) break;
+
+        if (wfd >= 0 && (fds[1].revents & (POLLOUT | POLLERR | POLLHUP))) {
+            const ssize_t w = write(wfd, input.data() + written, std::min<size_t>(input.size() - written, 1 << 16));
+            if (w > 0) written += w;
+            if (w < 0 || written == input.size()) {
+                close(wfd);
+                wfd = -1;
+            }
+        }
+        if (fds[0].revents & (POLLIN | POLLHUP | POLLERR)) {
+            const ssize_t r = read(out_pipe[0], buf, sizeof(buf));
+            if (r <= 0) break;
+            res.out.append(buf, r);
+        }
+    }
+    if (wfd >= 0) close(wfd);
+    close(out_pipe[0]);
+
+    waitpid(pid, &res.status, 0);
+    res.wall_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    return res;
+}
+
+[[nodiscard]]
+inline std::vector<std::string> split_tokens(const std::string& text) {
+    std::vector<std::string> res;
+    std::istringstream in(text);
+    for (std::string s; in >> s;) res.push_back(std::move(s));
+    return res;
+}
+
+[[nodiscard]]
+inline bool parse_number(const std::string& s, long double& v) {
+    char* end = nullptr;
+    v = std::strtold(s.c_str(), &end);
+    return !s.empty() && end == s.c_str() + s.size();
+}
+
+// Token-wise comparison; with eps >= 0 numeric tokens may differ by
+// absolute or relative error eps. Returns an empty string on success.
+[[nodiscard]]
+inline std::string compare_tokens(const std::string& got, const std::string& expected, double eps) {
+    const auto a = split_tokens(got), b = split_tokens(expected);
+    for (size_t i = 0; i < std::min(a.size(), b.size()); ++i) {
+        if (a[i] == b[i]) continue;
+        long double x, y;
+        if (eps >= 0 && parse_number(a[i], x) && parse_number(b[i], y)) {
+            const long double diff = std::fabs(x - y);
+            if (diff <= eps || diff <= eps * std::fabs(y)) continue;
+        }
+        return "token " + std::to_string(i + 1) + ": got " + a[i].substr(0, 32) +
+               ", expected " + b[i].substr(0, 32);
+    }
+    if (a.size() != b.size()) {
+        return "got " + std::to_string(a.size()) + " tokens, expected " + std::to_string(b.size());
+    }
+    return "";
+}
+
+}
+
+#endif
@@ -0,0 +1,234 @@
+// Stress tester: runs a generator, a brute force and a solution on random
+// inputs in parallel until their outputs differ, then shrinks the failing
+// input by delta debugging on its tokens.
+//
+// Build:  g++ -std=c++20 -O2 -pthread tools/stress.cpp -o stress
+// Usage:  ./stress <gen> <brute> <sol> [options]   (each a .cpp file or a binary)
+//   -n <count>   number of random tests (default 1000)
+//   -s <seed>    master seed (default 1)
+//   -j <n>       parallel jobs (default: number of cores)
+//   -t <sec>     timeout per run (default 5)
+//   -e <eps>     accept numeric tokens within absolute or relative error eps
+//   -f <flags>   extra compiler flags
+//
+// Test i runs the generator with a seed derived from the master seed as
+// argv[1]; generators should seed the template's mt19937_64 with it
+// instead of the clock, so every failure is reproducible from its seed.
+// The minimized input is printed and saved to stress_fail.in.
+#include "process.h"
+using namespace std;
+using namespace tools;
+
+struct options {
+    int tests = 1000;
+    uint64_t seed = 1;
+    int jobs = max(1u, thread::hardware_concurrency());
+    double timeout = 5.0;
+    double eps = -1;
+    string cxx_flags;
+};
+
+[[nodiscard]]
+uint64_t splitmix64(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+// Token of the input together with the whitespace that follows it,
+// so shrunk inputs keep their line layout
+struct piece { string token, sep; };
+
+[[nodiscard]]
+vector<piece> split_pieces(const string& text) {
+    vector<piece> res;
+    size_t i = 0;
+    while (i < text.size() && isspace((unsigned char)text[i])) ++i;
+    while (i < text.size()) {
+        size_t j = i;
+        while (j < text.size() && !isspace((unsigned char)text[j])) ++j;
+        size_t k = j;
+        while (k < text.size() && isspace((unsigned char)text[k])) ++k;
+        res.push_back({text.substr(i, j - i), text.substr(j, k - j)});
+        i = k;
+    }
+    return res;
+}
+
+[[nodiscard]]
+string join_pieces(const vector<piece>& ps) {
+    string res;
+    for (const auto& [token, sep] : ps) res += token + sep;
+    if (!res.empty() && res.back() != '\n') res += '\n';
+    return res;
+}
+
+struct stress {
+    string brute, sol;
+    options opt;
+    int runs = 0;
+
+    // Empty if the solution agrees with the brute force on input
+    // Inputs the brute force rejects never count as failures
+    [[nodiscard]]
+    optional<pair<string, string>> mismatch(const string& input) {
+        ++runs;
+        const auto expected = run_piped(brute, {}, input, opt.timeout);
+        if (!expected.ok()) return nullopt;
+        const auto got = run_piped(sol, {}, input, opt.timeout);
+        if (got.ok() && compare_tokens(got.out, expected.out, opt.eps).empty()) return nullopt;
+
+        string verdict = got.timed_out ? "[timeout]\n" : !got.ok() ? "[runtime error]\n" : "";
+        return pair{expected.out, verdict + got.out};
+    }
+
+    [[nodiscard]]
+    bool fails(const vector<piece>& ps) {
+        return !ps.empty() && mismatch(join_pieces(ps)).has_value();
+    }
+
+    // Zeller's ddmin over tokens: remove chunks at increasing granularity
+    // while the failure persists
+    void remove_tokens(vector<piece>& ps) {
+        int parts = 2;
+        while (ssize(ps) >= 2) {
+            const int chunk = (ssize(ps) + parts - 1) / parts;
+            bool reduced = false;
+            for (int start = 0; start < ssize(ps); start += chunk) {
+                vector<piece> cand(ps.begin(), ps.begin() + start);
+                cand.insert(cand.end(), ps.begin() + min<int>(start + chunk, ssize(ps)), ps.end());
+                if (fails(cand)) {
+                    ps = move(cand);
+                    parts = max(parts - 1, 2);
+                    reduced = true;
+                    break;
+                }
+            }
+            if (!reduced) {
+                if (parts >= ssize(ps)) break;
+                parts = min<int>(2 * parts, ssize(ps));
+            }
+        }
+    }
+
+    // Pull integer tokens towards zero while the failure persists
+    void shrink_values(vector<piece>& ps) {
+        for (bool changed = true; changed;) {
+            changed = false;
+            for (auto& p : ps) {
+                long long v;
+                const auto [end, ec] = from_chars(p.token.data(), p.token.data() + p.token.size(), v);
+                if (ec != errc() || end != p.token.data() + p.token.size() || v == 0) continue;
+
+                for (const long long c : {0LL, v / abs(v), v / 2, v - v / abs(v), -v}) {
+                    if (c == v || (v > 0 && c < 0) || llabs(c) > llabs(v)) continue;
+                    const string old = exchange(p.token, to_string(c));
+                    if (fails(ps)) {
+                        changed = true;
+                        break;
+                    }
+                    p.token = old;
+                }
+            }
+        }
+    }
+};
+
+int main(int argc, char** argv) {
+    if (argc < 4) {
+        cerr << "usage: " << argv[0] << " <gen> <brute> <sol> "
+             << "[-n count] [-s seed] [-j jobs] [-t sec] [-e eps] [-f flags]\n";
+        return 2;
+    }
+    signal(SIGPIPE, SIG_IGN);
+
+    options opt;
+    for (int i = 4; i < argc; i += 2) {
+        if (i + 1 == argc) {
+            cerr << "missing value for option " << argv[i] << "\n";
+            return 2;
+        }
+        const string flag = argv[i], val = argv[i + 1];
+        if (flag == "-n") opt.tests = stoi(val);
+        else if (flag == "-s") opt.seed = stoull(val);
+        else if (flag == "-j") opt.jobs = max(1, stoi(val));
+        else if (flag == "-t") opt.timeout = stod(val);
+        else if (flag == "-e") opt.eps = stod(val);
+        else if (flag == "-f") opt.cxx_flags = val;
+        else {
+            cerr << "unknown option " << flag << "\n";
+            return 2;
+        }
+    }
+
+    const fs::path work = make_work_dir("stress");
+    fs::create_directories(work / "gen");
+    fs::create_directories(work / "brute");
+    fs::create_directories(work / "sol");
+    const string gen = compile_if_source(argv[1], work / "gen", opt.cxx_flags);
+    const stress base{compile_if_source(argv[2], work / "brute", opt.cxx_flags),
+                      compile_if_source(argv[3], work / "sol", opt.cxx_flags), opt};
+
+    // Workers claim test indices in order; after a failure, only smaller
+    // indices keep running so the reported test does not depend on timing.
+    // A generator failure stops the run the same way and is reported by main
+    atomic<int> next = 0, first_fail = INT_MAX, gen_fail = INT_MAX, done = 0;
+    mutex lock;
+    string fail_input;
+    auto worker = [&] {
+        stress st = base;
+        for (int i; (i = next++) < opt.tests && i < first_fail && i < gen_fail;) {
+            const uint64_t seed = splitmix64(opt.seed + i);
+            const auto input = run_piped(gen, {to_string(seed)}, "", opt.timeout);
+            if (!input.ok()) {
+                lock_guard guard(lock);
+                gen_fail = min<int>(gen_fail, i);
+                continue;
+            }
+            if (st.mismatch(input.out)) {
+                lock_guard guard(lock);
+                if (i < first_fail) {
+                    first_fail = i;
+                    fail_input = input.out;
+                }
+            }
+            if (++done % 100 == 0) cerr << "[stress] " << done << " tests\r" << flush;
+        }
+    };
+    vector<thread> pool;
+    for (int j = 0; j < opt.jobs; ++j) pool.emplace_back(worker);
+    for (auto& th : pool) th.join();
+
+    if (gen_fail < first_fail) {
+        cerr << "[stress] generator failed on seed " << splitmix64(opt.seed + gen_fail) << "\n";
+        fs::remove_all(work);
+        return 1;
+    }
+    if (first_fail == INT_MAX) {
+        cerr << "[stress] all " << opt.tests << " tests passed\n";
+        fs::remove_all(work);
+        return 0;
+    }
+
+    cerr << "[stress] test " << first_fail << " (seed " << splitmix64(opt.seed + first_fail)
+         << ") failed, shrinking " << split_tokens(fail_input).size() << " tokens\n";
+
+    stress st = base;
+    auto ps = split_pieces(fail_input);
+    st.remove_tokens(ps);
+    st.shrink_values(ps);
+    st.remove_tokens(ps);
+
+    const string input = join_pieces(ps);
+    const auto [expected, got] = st.mismatch(input).value_or(pair{string(), string()});
+    ofstream("stress_fail.in") << input;
+
+    cerr << "[stress] shrunk to " << ps.size() << " tokens in " << st.runs << " runs, saved to stress_fail.in\n";
+    cout << "=== input ===\n" << input
+         << "=== expected ===\n" << expected
+         << "=== got ===\n" << got;
+
+    fs::remove_all(work);
+    return 1;
+}